@@ -0,0 +1,40 @@
+#ifndef ACCEPTANCEUTIL_H
+#define ACCEPTANCEUTIL_H
+
+//cpp
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+//fastjet
+#include "fastjet/PseudoJet.hh"
+
+//Acceptance model per input type (Trk, Tower): furthest |eta| at which an input or ghost can still change a kept jet
+//Kept jets reach jtMaxAbsEta + R, and global CS pulls ghosts from up to csMaxDR beyond that; capped at the input's own coverage
+//Snapped up to the next eta bin edge so every rho bin is either fully inside or fully outside
+inline double getAcceptanceAbsEta(const std::vector<float>& etaBins_, double inputMaxAbsEta, double jtMaxAbsEta, double jetR, double csMaxDR)
+{
+  double reach = jtMaxAbsEta + jetR + csMaxDR;
+  if(reach > inputMaxAbsEta) reach = inputMaxAbsEta;
+
+  for(unsigned int eI = 0; eI < etaBins_.size(); ++eI){
+    if(etaBins_[eI] >= reach - 1.e-4) return std::fmax(etaBins_[eI], reach); //Accumulated edges can sit a hair below reach
+  }
+
+  std::cout << "WARNING GETACCEPTANCEABSETA: Reach \'" << reach << "\' beyond eta bins (high edge \'" << etaBins_[etaBins_.size()-1] << "\'). return high edge" << std::endl;
+  return etaBins_[etaBins_.size()-1];
+}
+
+inline void pruneToAcceptance(std::vector<fastjet::PseudoJet>* particles_p, double maxAbsEta)
+{
+  unsigned int nKeep = 0;
+  for(unsigned int pI = 0; pI < particles_p->size(); ++pI){
+    if(std::fabs((*particles_p)[pI].eta()) > maxAbsEta) continue;
+    if(nKeep != pI) (*particles_p)[nKeep] = (*particles_p)[pI];
+    ++nKeep;
+  }
+  particles_p->resize(nKeep);
+  return;
+}
+
+#endif
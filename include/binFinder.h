@@ -0,0 +1,107 @@
+#ifndef BINFINDER_H
+#define BINFINDER_H
+
+//cpp
+#include <string>
+#include <vector>
+
+//Bin lookup shared by rhoBuilder, ghostUtil and centralityFromInput
+//Uniform binning (within tolerance) is found arithmetically; non-uniform edges fall back to a branch-free binary search
+//Either way the returned position is exact w.r.t. the stored edges, i.e. identical to a linear scan
+class binFinder
+{
+ public:
+  binFinder(){};
+  binFinder(std::vector<float> inBins, std::string inLabel = "BINFINDER", bool inDoClamp = true, bool inLowEdgeInclusive = true);
+  binFinder(std::vector<double> inBins, std::string inLabel = "BINFINDER", bool inDoClamp = true, bool inLowEdgeInclusive = true);
+  ~binFinder(){};
+
+  bool Init(std::vector<float> inBins, std::string inLabel = "BINFINDER", bool inDoClamp = true, bool inLowEdgeInclusive = true);
+  bool Init(std::vector<double> inBins, std::string inLabel = "BINFINDER", bool inDoClamp = true, bool inLowEdgeInclusive = true);
+
+  //Clamped mode: out of range returns first/last bin (w/ rate-limited warning); unclamped mode: out of range returns -1
+  inline int FindBin(double val);
+  void FindBins(const float* vals_p, unsigned int nVals, int* pos_p);
+  void FindBins(const double* vals_p, unsigned int nVals, int* pos_p);
+  void FindBins(const std::vector<float>* vals_p, std::vector<int>* pos_p);
+  void FindBins(const std::vector<double>* vals_p, std::vector<int>* pos_p);
+
+  bool GetIsInit(){return m_isInit;}
+  bool GetIsUniform(){return m_isUniform;}
+  int GetNBins(){return m_nBins;}
+  const std::vector<double>* GetBins(){return &m_bins;}
+  double GetBinLowEdge(int pos){return m_bins[pos];}
+  double GetBinHighEdge(int pos){return m_bins[pos+1];}
+  unsigned long long GetNWarnings(){return m_nWarnings;}
+  void Clean();
+  void Print();
+
+ private:
+  bool m_isInit = false;
+  bool m_isUniform = false;
+  bool m_doClamp = true;
+  bool m_lowEdgeInclusive = true;
+
+  std::string m_label;
+  std::vector<double> m_bins;
+  int m_nBins = 0;
+  double m_low = 0.0;
+  double m_high = 0.0;
+  double m_invWidth = 0.0;
+
+  const unsigned long long m_maxWarnings = 10;
+  unsigned long long m_nWarnings = 0;
+
+  int OutOfRange(double val);
+  bool CountWarning();
+  void Warn(std::string warnStr);
+};
+
+inline int binFinder::FindBin(double val)
+{
+  //Written so NaN also lands in OutOfRange
+  if(m_lowEdgeInclusive){
+    if(!(val >= m_low && val < m_high)) return OutOfRange(val);
+  }
+  else if(!(val > m_low && val <= m_high)) return OutOfRange(val);
+
+  const double* bins = m_bins.data();
+  int pos = 0;
+  if(m_isUniform){
+    pos = (int)((val - m_low)*m_invWidth);
+    if(pos > m_nBins - 1) pos = m_nBins - 1;
+    //Accumulated edges are only approximately uniform - nudge to the exact edge convention
+    if(m_lowEdgeInclusive){
+      while(pos > 0 && val < bins[pos]) --pos;
+      while(pos < m_nBins - 1 && val >= bins[pos+1]) ++pos;
+    }
+    else{
+      while(pos > 0 && val <= bins[pos]) --pos;
+      while(pos < m_nBins - 1 && val > bins[pos+1]) ++pos;
+    }
+  }
+  else{
+    //Branch-free lower bound over the low edges
+    const double* base = bins;
+    int n = m_nBins;
+    if(m_lowEdgeInclusive){
+      while(n > 1){
+	const int half = n/2;
+	base = (base[half] <= val) ? base + half : base;
+	n -= half;
+      }
+    }
+    else{
+      while(n > 1){
+	const int half = n/2;
+	base = (base[half] < val) ? base + half : base;
+	n -= half;
+      }
+    }
+    pos = base - bins;
+  }
+
+  return pos;
+}
+
+#endif
@@ -7,6 +7,7 @@
 #include <vector>
 
 //Local
+#include "include/binFinder.h"
 #include "include/checkMakeDir.h"
 
 class centralityFromInput
@@ -23,6 +24,7 @@ class centralityFromInput
   bool isInit;
   bool isDescending;
   std::vector<double> centVals;
+  binFinder centBins; //Ascending copy of centVals; bin pos maps directly to centrality for descending tables
 };
 
 #endif
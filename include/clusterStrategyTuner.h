@@ -0,0 +1,76 @@
+#ifndef CLUSTERSTRATEGYTUNER_H
+#define CLUSTERSTRATEGYTUNER_H
+
+//cpp
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//FastJet
+#include "fastjet/ClusterSequence.hh"
+
+//Picks the FastJet clustering strategy (N2Tiled, N2MinHeapTiled, NlnN) per clustering kind and multiplicity band, by timing the
+//candidates on the job's own first events. Bands are powers of two of the clustered multiplicity, ghosts included, so they follow
+//centrality w/o needing it. Until a band has nSamples timings of every candidate its clusterings rotate through the candidates,
+//afterwards all of them use the fastest mean. Decided bands are read from and written to a cache file so later jobs start tuned
+//Jets are the same for every strategy up to tie ordering: exactly equal distances (e.g. between lattice ghosts) may be merged in
+//a different order, so a tuned job is not guaranteed bit-identical to an untuned one. Start/Stop are thread-safe, for concurrent event tasks
+class clusterStrategyTuner
+{
+ public:
+  struct ticket{
+    int band = -1;
+    unsigned int kind = 0;
+    int stratPos = -1; //-1 when nothing is timed
+    std::chrono::steady_clock::time_point start;
+  };
+
+  clusterStrategyTuner(){};
+  ~clusterStrategyTuner(){};
+
+  //inDoTune false hands back baseJetDef for every clustering; an empty cache file name tunes w/o reading or writing a cache
+  bool Init(const fastjet::JetDefinition& baseJetDef, std::vector<std::string> inKindNames, bool inDoTune, unsigned int inNSamples, std::string inCacheFileName);
+
+  //Jet definition for the next clustering of nInputs; cluster w/ it right away and Stop the ticket once the sequence is built
+  const fastjet::JetDefinition& Start(unsigned int kind, unsigned int nInputs, ticket* ticket_p);
+  void Stop(ticket* ticket_p);
+
+  bool WriteCache();
+
+  bool GetIsInit(){return m_isInit;}
+  bool GetDoTune(){return m_doTune;}
+  void Clean();
+  void Print();
+
+  static std::string StrategyToStr(fastjet::Strategy strategy);
+
+ private:
+  static const int nBand = 32;
+
+  struct bandState{
+    int winner = -1;
+    double winnerMeanSeconds = 0.0;
+    bool fromCache = false;
+    std::vector<unsigned int> nIssued, nDone;
+    std::vector<double> seconds;
+  };
+
+  bool m_isInit = false;
+  bool m_doTune = false;
+  unsigned int m_nSamples = 0;
+  std::string m_cacheFileName = "";
+
+  fastjet::JetDefinition m_baseJetDef;
+  std::vector<fastjet::Strategy> m_strategies; //Candidates that FastJet accepts for this jet definition
+  std::vector<fastjet::JetDefinition> m_jetDefs; //Per candidate
+  std::vector<std::string> m_kindNames;
+  std::vector<bandState> m_bands; //[kind][band]
+
+  std::mutex m_mutex;
+
+  int GetBand(unsigned int nInputs);
+  bool ReadCache();
+};
+
+#endif
@@ -1,9 +1,11 @@
 //Author: Chris McGinn (2020.01.23)
 
+#ifndef CONSTITUENTBUILDER_H
+#define CONSTITUENTBUILDER_H
+
 //cpp
 #include <cmath>
 #include <iostream>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -13,29 +15,62 @@
 //Local
 #include "include/globalDebugHandler.h"
 
+//Builds the clustering inputs for one event; outputs are owned by the builder and returned by const reference
+//Storage is only cleared (never released) by Clean(), so a builder kept across events reuses its capacity
+//Repeating an Init w/ identical arguments before the next Clean() is a no-op - every stage of an event can share one build
+//Identical means the same vectors w/ the same size and contents (a hash over them, checked per Init), so vectors refilled in place
+//for the next event are rebuilt even w/o a Clean() in between
 class constituentBuilder
 {
  public:
   constituentBuilder(){};
-  constituentBuilder(std::vector<float>* pt_p, std::vector<float>* eta_p, std::vector<float>* phi_p, double inUserMinPt = -1);
+  constituentBuilder(std::vector<float>* pt_p, std::vector<float>* eta_p, std::vector<float>* phi_p, double inUserMinPt = -1, double inUserMaxAbsEta = -1);
   ~constituentBuilder(){};
   
-  bool InitPtEtaPhi(std::vector<float>* pt_p, std::vector<float>* eta_p, std::vector<float>* phi_p, double inUserMinPt = -1);
-  bool InitPtEtaPhiID(std::vector<float>* pt_p, std::vector<float>* eta_p, std::vector<float>* phi_p, std::vector<bool>* tight_p, double inUserMinPt = -1);
-  std::vector<fastjet::PseudoJet> GetCleanInputs();
-  std::vector<fastjet::PseudoJet> GetGhostedInputs();
-  std::vector<fastjet::PseudoJet> GetAllInputs();
+  //inUserMaxAbsEta > 0 drops inputs outside the acceptance from the clustered collections (pt_p is still min-pt swapped for them)
+  bool InitPtEtaPhi(std::vector<float>* pt_p, std::vector<float>* eta_p, std::vector<float>* phi_p, double inUserMinPt = -1, double inUserMaxAbsEta = -1);
+  //ID variant leaves pt_p untouched; user index is the position among inputs passing the ID
+  bool InitPtEtaPhiID(std::vector<float>* pt_p, std::vector<float>* eta_p, std::vector<float>* phi_p, std::vector<bool>* tight_p, double inUserMinPt = -1, double inUserMaxAbsEta = -1);
+  const std::vector<fastjet::PseudoJet>& GetCleanInputs();
+  const std::vector<fastjet::PseudoJet>& GetGhostedInputs();
+  const std::vector<fastjet::PseudoJet>& GetAllInputs(); //Clean followed by ghosted, concatenated once per build
+  bool GetIsInit(){return m_isInit;}
   bool IsUserIndexGhosted(unsigned int inUserIndex);
   void Clean();
   
  private:
   globalDebugHandler gBug;
-  bool m_doGlobalDebug;
+  bool m_doGlobalDebug = false;
 
   const double minPt = 0.001;
+
+  //Arguments of the current build - an Init w/ the same key returns it as is
+  bool m_isInit = false;
+  const std::vector<float>* m_keyPt_p = nullptr;
+  const std::vector<float>* m_keyEta_p = nullptr;
+  const std::vector<float>* m_keyPhi_p = nullptr;
+  const std::vector<bool>* m_keyID_p = nullptr;
+  double m_keyMinPt = -1;
+  double m_keyMaxAbsEta = -1;
+  unsigned int m_keySize = 0;
+  unsigned long long m_keyHash = 0; //Of the contents after the build, i.e. w/ the min-pt swap written back
+
+  bool Build(std::vector<float>* pt_p, std::vector<float>* eta_p, std::vector<float>* phi_p, std::vector<bool>* id_p, double inUserMinPt, double inUserMaxAbsEta);
+  unsigned long long ContentHash(const std::vector<float>* pt_p, const std::vector<float>* eta_p, const std::vector<float>* phi_p, const std::vector<bool>* id_p);
   
-  std::map<unsigned int, double> mapToOrigPt;
-  std::map<unsigned int, bool> mapToIsSwapped;
+  //Dense per-user-index storage - Clean() only clears, so capacity is kept across events
+  enum inputState : unsigned char {inputNotFound = 0, inputClean = 1, inputSwapped = 2};
+  std::vector<double> origPt;
+  std::vector<unsigned char> userIndexState;
   std::vector<fastjet::PseudoJet> cleanInputs; // This is the collection 'to-be-clustered' at the end of day
   std::vector<fastjet::PseudoJet> ghostedInputs; // This is the collection that is ghosted w/ neg values
+  std::vector<fastjet::PseudoJet> allInputs;
+  bool m_allInputsIsBuilt = false;
+
+  //SoA scratch for the batched 4-momentum conversion, reused across builds
+  std::vector<float> keptPt, keptEta, keptPhi;
+  std::vector<unsigned int> keptUserIndex;
+  std::vector<double> keptPx, keptPy, keptPz, keptE;
 };
+
+#endif
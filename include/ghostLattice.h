@@ -0,0 +1,67 @@
+#ifndef GHOSTLATTICE_H
+#define GHOSTLATTICE_H
+
+//cpp
+#include <string>
+#include <vector>
+
+//FastJet
+#include "fastjet/PseudoJet.hh"
+
+//Local
+#include "include/binFinder.h"
+
+//Persistent ghost set, placed once per job w/ fastjet's GhostedAreaSpec under a fixed seed
+//Per-ghost eta bin and unit-direction components are cached in structure-of-arrays form, so rescaling to a new rho is one multiply per component
+//Ghosts handed out by GetGhosts() carry their lattice position in user_index (see GetLatticePos) so jet constituents map back to the cache
+class ghostLattice
+{
+ public:
+  ghostLattice(){};
+  ghostLattice(std::vector<float> inEtaBins, double inMaxAbsEta, double inGhostArea, int inSeed);
+  ~ghostLattice(){};
+
+  bool Init(std::vector<float> inEtaBins, double inMaxAbsEta, double inGhostArea, int inSeed);
+  const std::vector<fastjet::PseudoJet>& GetGhosts(){return m_ghosts;}
+  int GetLatticePos(int userIndex){return (userIndex <= -2 && -2 - userIndex < (int)m_nGhosts) ? -2 - userIndex : -1;}
+
+  //Same semantics as the per-ghost rescale it replaces: ghosts beyond rescaleEtaCap untouched, nonsense near-zero rescales skipped
+  bool RescaleGhosts(const std::vector<float>& rho_, std::vector<fastjet::PseudoJet>* ghosts_p, double rescaleEtaCap = 100.);
+
+  bool GetIsInit(){return m_isInit;}
+  unsigned int GetNGhosts(){return m_nGhosts;}
+  double GetGhostArea(){return m_ghostArea;} //Actual area per ghost, what the explicit-ghost cluster sequences must be given
+  double GetRequestedGhostArea(){return m_requestedGhostArea;}
+  unsigned long long GetNFallback(){return m_nFallback;}
+  void Clean();
+  void Print();
+
+ private:
+  bool m_isInit = false;
+  double m_maxAbsEta = 0.0;
+  double m_requestedGhostArea = 0.0;
+  double m_ghostArea = 0.0; //GhostedAreaSpec::actual_ghost_area()
+  int m_seed = 0;
+  unsigned int m_nGhosts = 0;
+  unsigned long long m_nFallback = 0;
+
+  binFinder m_etaBinFinder;
+  std::vector<fastjet::PseudoJet> m_ghosts;
+
+  //SoA cache, all indexed by lattice position
+  std::vector<int> m_etaPos;
+  std::vector<double> m_absEta;
+  std::vector<double> m_ux; //cos(phi)/cosh(eta)
+  std::vector<double> m_uy; //sin(phi)/cosh(eta)
+  std::vector<double> m_uz; //tanh(eta)
+
+  //Rescaled four-momenta of the full lattice for the current rho
+  std::vector<double> m_E;
+  std::vector<double> m_px;
+  std::vector<double> m_py;
+  std::vector<double> m_pz;
+
+  void RescaleGhostFallback(const std::vector<float>& rho_, fastjet::PseudoJet* ghost_p, double rescaleEtaCap);
+};
+
+#endif
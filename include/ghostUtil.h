@@ -8,7 +8,11 @@
 //fastjet
 #include "fastjet/PseudoJet.hh"
 
-inline int ghostPos(std::vector<float> bins_, double ghostVal)
+//Local
+#include "include/binFinder.h"
+
+//Linear scan kept for one-off lookups; per-ghost/per-particle loops should build a binFinder once and use the overloads below
+inline int ghostPos(const std::vector<float>& bins_, double ghostVal)
 {
   if(bins_.size() == 0){
     std::cout << "MAKECLUSTERTREE GHOSTPOS ERROR: Given bins have size \'0\'. returning int32 max for absurd result" << std::endl;
@@ -35,8 +39,14 @@ inline int ghostPos(std::vector<float> bins_, double ghostVal)
   return ghostPos;
 }
 
-inline int ghostEtaPos(std::vector<float> etaBins_, fastjet::PseudoJet ghost){return ghostPos(etaBins_, ghost.eta());}
+inline int ghostEtaPos(const std::vector<float>& etaBins_, const fastjet::PseudoJet& ghost){return ghostPos(etaBins_, ghost.eta());}
+
+inline int ghostPhiPos(const std::vector<float>& phiBins_, const fastjet::PseudoJet& ghost){return ghostPos(phiBins_, ghost.phi_std());}
+
+inline int ghostPos(binFinder* bins_, double ghostVal){return bins_->FindBin(ghostVal);}
+
+inline int ghostEtaPos(binFinder* etaBins_, const fastjet::PseudoJet& ghost){return etaBins_->FindBin(ghost.eta());}
 
-inline int ghostPhiPos(std::vector<float> phiBins_, fastjet::PseudoJet ghost){return ghostPos(phiBins_, ghost.phi_std());}
+inline int ghostPhiPos(binFinder* phiBins_, const fastjet::PseudoJet& ghost){return phiBins_->FindBin(ghost.phi_std());}
 
 #endif
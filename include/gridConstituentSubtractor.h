@@ -0,0 +1,107 @@
+#ifndef GRIDCONSTITUENTSUBTRACTOR_H
+#define GRIDCONSTITUENTSUBTRACTOR_H
+
+//cpp
+#include <string>
+#include <vector>
+
+//FastJet
+#include "fastjet/PseudoJet.hh"
+
+//In-house constituent subtraction, same greedy particle-ghost matching as fjcontrib's ConstituentSubtractor w/ the deltaR distance
+//Pairs are ordered on dR^2*pt^(2*alpha), the square of fjcontrib's pt^alpha*dR, and only pairs within maxDistance are formed:
+//ghosts are bucketed on an eta-phi cell grid of cell size maxDistance, so each particle only visits its 3x3 neighbouring cells
+//Pairs are sorted in growing chunks and the matching stops once every particle or every ghost is used up. Particles and ghosts
+//are held in SoA scratch that is reused between calls
+//Output particles keep input order and user_index, w/ the subtracted pt at the input rapidity/phi and zero mass; particles beyond
+//maxEta are dropped. maxDistance <= 0 pairs everything
+//Iterative use (global CS w/ rho re-derived between passes): SetIterativeInputs forms the candidate pairs of one particle set and
+//the ghost positions once, and each DoIterativePass only re-weights them - ghost pt is read per pass, and a pass continuing from the
+//previous result re-sorts only the pairs of particles whose pt changed, merging them into the kept order
+class gridConstituentSubtractor
+{
+ public:
+  gridConstituentSubtractor(){};
+  gridConstituentSubtractor(double inMaxDistance, double inAlpha, double inMaxEta);
+  ~gridConstituentSubtractor(){};
+
+  bool Init(double inMaxDistance, double inAlpha, double inMaxEta);
+  void SetMaxDistance(double inMaxDistance){m_maxDistance = inMaxDistance;}
+  void SetAlpha(double inAlpha){m_alpha = inAlpha;}
+  void SetMaxEta(double inMaxEta){m_maxEta = inMaxEta;}
+  void SetRemoveAllZeroPtParticles(bool inRemoveZeroPt){m_removeZeroPt = inRemoveZeroPt;}
+
+  //Ghosts w/ pt left after the matching are appended to remainingGhosts_p, scaled down to that pt
+  bool DoSubtraction(const std::vector<fastjet::PseudoJet>& particles, const std::vector<fastjet::PseudoJet>& ghosts, std::vector<fastjet::PseudoJet>* subtracted_p, std::vector<fastjet::PseudoJet>* remainingGhosts_p = nullptr);
+
+  //Candidates are formed within maxIterDistance (the largest distance of any later pass) from the ghost positions, so call it w/ the
+  //unscaled ghosts - zero pt ghosts have no direction. Particles are copied, the caller's vectors can change afterwards
+  bool SetIterativeInputs(const std::vector<fastjet::PseudoJet>& particles, const std::vector<fastjet::PseudoJet>& ghosts, double maxIterDistance);
+  //One pass at maxDistance <= maxIterDistance and the current alpha. ghosts must be the same collection in the same order, only pt
+  //may differ. fromPrevious starts from the previous pass's subtracted pt, as a second DoSubtraction on that output would
+  bool DoIterativePass(const std::vector<fastjet::PseudoJet>& ghosts, double maxDistance, bool fromPrevious, std::vector<fastjet::PseudoJet>* subtracted_p, std::vector<fastjet::PseudoJet>* remainingGhosts_p = nullptr);
+
+  //Parity of two subtracted collections: same particles (user_index) in the same order, pt within tolerance*(1 + pt) and rap/phi
+  //within tolerance. Used to check against a fjcontrib reference run on the same inputs
+  static bool CheckParity(const std::vector<fastjet::PseudoJet>& test, const std::vector<fastjet::PseudoJet>& reference, double tolerance, std::string* reason_p = nullptr);
+
+  bool GetIsInit(){return m_isInit;}
+  unsigned long long GetNPairs(){return m_nPairsTotal;} //Candidate pairs formed, summed over calls
+  unsigned long long GetNPairsUsed(){return m_nPairsUsedTotal;} //Pairs reached before the matching stopped
+  void Clean();
+  void Print();
+
+ private:
+  bool m_isInit = false;
+  double m_maxDistance = 0.0;
+  double m_alpha = 0.0;
+  double m_maxEta = 0.0;
+  bool m_removeZeroPt = false;
+
+  unsigned long long m_nPairsTotal = 0;
+  unsigned long long m_nPairsUsedTotal = 0;
+
+  //SoA scratch, particles then ghosts - positions are into the selected (|eta| <= maxEta) subsets
+  std::vector<unsigned int> m_pIndex;
+  std::vector<double> m_pRap, m_pPhi, m_pPtFactor, m_pPtLeft;
+  std::vector<unsigned int> m_gIndex;
+  std::vector<double> m_gRap, m_gPhi, m_gPt, m_gPtLeft;
+
+  //Ghost cell grid as a counting sort: ghosts of cell c are m_cellGhosts[m_cellStart[c], m_cellStart[c+1])
+  int m_nRapCells = 0;
+  int m_nPhiCells = 0;
+  double m_rapMin = 0.0;
+  double m_rapCellSize = 0.0;
+  double m_phiCellSize = 0.0;
+  std::vector<unsigned int> m_cellStart;
+  std::vector<unsigned int> m_cellGhosts;
+  std::vector<int> m_ghostCell;
+
+  struct csPair{
+    double metric;
+    double dR2;
+    unsigned int pPos, gPos;
+  };
+  std::vector<csPair> m_pairs;
+
+  //Iterative state, apart from the DoSubtraction scratch so one-shot calls can run between passes
+  bool m_iterIsSet = false;
+  bool m_iterHasPass = false;
+  double m_iterMaxDistance = 0.0;
+  unsigned int m_iterNGhosts = 0;
+  std::vector<fastjet::PseudoJet> m_iterParticles; //Selected particles, template of the output
+  std::vector<double> m_iterPRap, m_iterPPhi, m_iterPPt, m_iterPPtPrev, m_iterPPtFactor, m_iterPPtLeft;
+  std::vector<unsigned int> m_iterGIndex;
+  std::vector<double> m_iterGPt, m_iterGPtLeft;
+  std::vector<csPair> m_iterPairs; //Every candidate, sorted on the input pt metric of m_iterSortedAlpha
+  bool m_iterIsSorted = false;
+  double m_iterSortedAlpha = 0.0;
+  std::vector<csPair> m_iterKept, m_iterChanged, m_iterMerged;
+
+  static bool PairLess(const csPair& a, const csPair& b); //Metric, ties on particle then ghost position
+  void BuildGrid(double maxDistance);
+  void FormPairs(double maxDistance, std::vector<csPair>* pairs_p);
+  int GetPhiCell(double phi);
+};
+
+#endif
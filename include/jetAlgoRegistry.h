@@ -0,0 +1,82 @@
+#ifndef JETALGOREGISTRY_H
+#define JETALGOREGISTRY_H
+
+//cpp
+#include <string>
+#include <vector>
+
+//Dense integer IDs for the reclustered jet algorithms ("TrkCSGlobalAlpha1IterRho0", ...), built once before the event loop
+//ID == position in the output tree's algo arrays; per-ID attributes and the (input, flavour, alpha, iteration, scan point) -> ID table
+//are plain arrays, so event loops index instead of building and comparing strings. GetID returns -1 for combinations not registered
+//CS algos of scan point N > 0 carry a "ScanN" suffix; scan point 0 is the nominal parameter set and keeps the plain names
+class jetAlgoRegistry{
+ public:
+  enum inputType{inputTrk = 0, inputTower = 1, nInputType = 2};
+  enum algoFlavour{flavNoSub = 0, flav4GeVCut = 1, flavCSJetByJet = 2, flavCSGlobal = 3, flavCSGlobalIter = 4, nAlgoFlavour = 5};
+  static const int nMaxAlgo = 128; //Bound on the algos of one tree - sizes the fixed per-algo arrays of the tree writer and readers
+
+  jetAlgoRegistry(){};
+  ~jetAlgoRegistry(){};
+
+  //Build the makeClusterTree set, in its output order: per input NoSub, 4GeVCut (tracks only), then per iteration, alpha, CS flavour
+  bool Init(bool doTracks, bool doTowers, std::vector<int> inAlphaParams, int inNIterRho);
+  //Same, but only the stages listed per input ("NoSub,CSGlobal", ...); an empty list turns the input off. Order in the list is
+  //ignored - registration keeps the canonical order above, so the output layout only depends on which stages are on
+  //Every CS stage is registered once per scan point, point 0 first
+  bool InitFromStages(std::string trkStages, std::string towerStages, std::vector<int> inAlphaParams, int inNIterRho, int inNScanPoint = 1);
+  //Recover the registry from an output tree's JTALGOS list - IDs follow the list order
+  bool Init(std::vector<std::string> inAlgoNames);
+
+  int GetID(inputType input, algoFlavour flavour, unsigned int alphaPos = 0, int iterRho = 0, int scanPos = 0) const
+  {
+    if(alphaPos >= m_nAlphaPos || iterRho < 0 || iterRho >= m_nIterRho || scanPos < 0 || scanPos >= m_nScanPoint) return -1;
+    return m_idTable[(((input*nAlgoFlavour + flavour)*m_nAlphaPos + alphaPos)*m_nIterRho + iterRho)*m_nScanPoint + scanPos];
+  }
+  int GetID(std::string algoName) const; //Name lookup, for setup code only
+
+  unsigned int GetNAlgo() const {return m_names.size();}
+  const std::vector<std::string>& GetNames() const {return m_names;}
+  const std::string& GetName(unsigned int id) const {return m_names[id];}
+  inputType GetInputType(unsigned int id) const {return m_input[id];}
+  algoFlavour GetFlavour(unsigned int id) const {return m_flavour[id];}
+  int GetAlpha(unsigned int id) const {return m_alpha[id];} //0 for NoSub/4GeVCut
+  int GetIterRho(unsigned int id) const {return m_iterRho[id];} //0 for NoSub/4GeVCut
+  int GetScanPos(unsigned int id) const {return m_scanPos[id];} //0 for NoSub/4GeVCut
+  int GetNScanPoint() const {return m_nScanPoint;}
+  bool IsTrk(unsigned int id) const {return m_input[id] == inputTrk;}
+  bool IsCS(unsigned int id) const {return m_flavour[id] >= flavCSJetByJet;}
+  bool HasStage(inputType input, algoFlavour flavour) const {return m_hasStage[input*nAlgoFlavour + flavour];}
+  bool HasCSStage(inputType input) const {return HasStage(input, flavCSJetByJet) || HasStage(input, flavCSGlobal) || HasStage(input, flavCSGlobalIter);}
+
+  bool GetIsInit() const {return m_isInit;}
+  void Clean();
+  void Print() const;
+
+  static std::string InputTypeToStr(inputType input);
+  static std::string FlavourToStr(algoFlavour flavour);
+  static std::string GetDefaultStages(inputType input); //The full chain, as run before stages were configurable
+
+ private:
+  bool m_isInit = false;
+  std::vector<int> m_alphaParams;
+  unsigned int m_nAlphaPos = 0; //Table extents, at least 1 so NoSub/4GeVCut have a slot
+  int m_nIterRho = 0;
+  int m_nScanPoint = 0;
+  bool m_hasStage[nInputType*nAlgoFlavour] = {false}; //[input][flavour]
+
+  std::vector<std::string> m_names;
+  std::vector<inputType> m_input;
+  std::vector<algoFlavour> m_flavour;
+  std::vector<int> m_alpha;
+  std::vector<int> m_iterRho;
+  std::vector<int> m_scanPos;
+
+  std::vector<int> m_idTable; //[input][flavour][alphaPos][iterRho][scanPos] -> ID or -1
+
+  bool Add(inputType input, algoFlavour flavour, int alpha, int iterRho, int scanPos);
+  bool ParseStages(inputType input, std::string stages, bool* hasStage_p);
+  bool ParseName(std::string algoName, inputType* input_p, algoFlavour* flavour_p, int* alpha_p, int* iterRho_p, int* scanPos_p);
+  void FillIDTable();
+};
+
+#endif
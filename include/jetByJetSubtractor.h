@@ -0,0 +1,103 @@
+#ifndef JETBYJETSUBTRACTOR_H
+#define JETBYJETSUBTRACTOR_H
+
+//cpp
+#include <algorithm>
+#include <vector>
+
+//FastJet
+#include "fastjet/ClusterSequenceArea.hh"
+#include "fastjet/PseudoJet.hh"
+
+//FastJet contrib
+#include "fastjet/contrib/ConstituentSubtractor.hh"
+
+//Local
+#include "include/constituentBuilder.h"
+#include "include/ghostLattice.h"
+#include "include/gridConstituentSubtractor.h"
+
+//Batched jet-by-jet constituent subtraction over all jets of one clustering
+//SetJets reads the real/ghost membership of every jet from the clustering history into flat per-jet ranges, in constituents() order
+//but w/o the per-jet constituents() vectors. The caller rescales all jet ghosts at once through GetGhosts_p(), and each DoSubtraction
+//runs one configured engine (fjcontrib or gridConstituentSubtractor) over every jet, returning one subtracted four-vector per jet
+class jetByJetSubtractor
+{
+ public:
+  //Ghost-to-jet partition agreement of two membership fills of the same event, summed over events by ComparePartition
+  struct partitionCheck{
+    unsigned long long nGhosts = 0; //Lattice ghosts compared
+    unsigned long long nGhostsSame = 0; //..owned by the same jet, or by no jet w/ reals, in both
+    unsigned long long nJets = 0; //Jets w/ real pt >= minJetPt
+    double sumAbsRelArea = 0.0; //|ghost count - reference ghost count|/reference ghost count, summed over those jets
+    double maxAbsRelArea = 0.0;
+
+    void Add(const partitionCheck& other){
+      nGhosts += other.nGhosts;
+      nGhostsSame += other.nGhostsSame;
+      nJets += other.nJets;
+      sumAbsRelArea += other.sumAbsRelArea;
+      maxAbsRelArea = std::max(maxAbsRelArea, other.maxAbsRelArea);
+    }
+  };
+
+  jetByJetSubtractor(){};
+  jetByJetSubtractor(double inMaxEta, bool inUseGrid);
+  ~jetByJetSubtractor(){};
+
+  bool Init(double inMaxEta, bool inUseGrid);
+  void SetParityTolerance(double inTolerance){m_parityTol = inTolerance;} //Grid engine only; > 0 reruns fjcontrib on every jet and counts mismatches
+
+  //jets must come from cs. Real constituents w/ realFilter_p->IsUserIndexGhosted (ghosted negative inputs) are dropped if given
+  bool SetJets(const fastjet::ClusterSequenceAreaBase& cs, const std::vector<fastjet::PseudoJet>& jets, constituentBuilder* realFilter_p = nullptr);
+  //Same contract w/o the explicit ghosts: cs clusters the real inputs only, then each lattice ghost goes to the jet w/in jetR of it that
+  //anti-kt would merge it into (smallest dR^2/pt^2, ties to the lower jet). Ghosts near no jet form one trailing jet w/o reals, as the
+  //pure-ghost jets of the explicit path do, so the jet ghosts still cover the whole lattice
+  bool SetJetsGeometric(const fastjet::ClusterSequence& cs, const std::vector<fastjet::PseudoJet>& jets, ghostLattice* lattice_p, double jetR, constituentBuilder* realFilter_p = nullptr);
+  //Compares this partition to ref_p's (same event and lattice, e.g. geometric vs. explicit); jets are matched through their reals
+  bool ComparePartition(jetByJetSubtractor* ref_p, ghostLattice* lattice_p, double minJetPt, partitionCheck* check_p);
+  void ResetGhosts(){m_ghosts = m_ghostsUnscaled;} //Working ghosts back to the unscaled ones, as SetJets leaves them
+  std::vector<fastjet::PseudoJet>* GetGhosts_p(){return &m_ghosts;} //All jet ghosts, jet by jet - rescale in place before DoSubtraction
+  const std::vector<fastjet::PseudoJet>& GetUnscaledGhosts(){return m_ghostsUnscaled;}
+
+  //One entry per jet: the join of its subtracted constituents w/ pt >= minConstPt; a zero four-vector if the jet has no real
+  //constituents (GetNReal(jI) == 0)
+  bool DoSubtraction(double maxDistance, double alpha, std::vector<fastjet::PseudoJet>* subtractedJets_p, double minConstPt = 0.0);
+
+  unsigned int GetNJets(){return m_realStart.size() == 0 ? 0 : m_realStart.size() - 1;}
+  unsigned int GetNReal(unsigned int jI){return m_realStart[jI + 1] - m_realStart[jI];}
+  unsigned int GetNGhost(unsigned int jI){return m_ghostStart[jI + 1] - m_ghostStart[jI];}
+  bool GetIsInit(){return m_isInit;}
+  gridConstituentSubtractor* GetGridEngine_p(){return &m_gridCS;}
+  unsigned long long GetNParityChecked(){return m_nParityChecked;}
+  unsigned long long GetNParityFailed(){return m_nParityFailed;}
+  void Clean();
+  void Print();
+
+ private:
+  bool m_isInit = false;
+  bool m_useGrid = false;
+  double m_maxEta = 0.0;
+  double m_parityTol = 0.0;
+  unsigned long long m_nParityChecked = 0;
+  unsigned long long m_nParityFailed = 0;
+
+  fastjet::contrib::ConstituentSubtractor m_fjCS;
+  gridConstituentSubtractor m_gridCS;
+
+  //Jet jI owns [m_realStart[jI], m_realStart[jI+1]) of m_real, same for ghosts
+  std::vector<fastjet::PseudoJet> m_real;
+  std::vector<unsigned int> m_realStart;
+  std::vector<fastjet::PseudoJet> m_ghostsUnscaled, m_ghosts;
+  std::vector<unsigned int> m_ghostStart;
+
+  void ReadJetHistory(const fastjet::ClusterSequence& cs, const fastjet::ClusterSequenceAreaBase* area_p, const std::vector<fastjet::PseudoJet>& jets, constituentBuilder* realFilter_p);
+
+  //Scratch
+  std::vector<int> m_histStack;
+  std::vector<unsigned int> m_cellStart, m_cellJets; //Jet axes by rapidity-phi cell, for SetJetsGeometric
+  std::vector<int> m_ghostOwner, m_refJetOfReal, m_refOwner;
+  std::vector<fastjet::PseudoJet> m_jetReal, m_jetGhosts, m_subtracted, m_reference;
+};
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef JETMATCHER_H
+#define JETMATCHER_H
+
+//cpp
+#include <string>
+#include <vector>
+
+//One-to-one eta-phi jet matching w/in maxDR. Targets are binned once into cells at least maxDR wide (SetTargets), then any number
+//of source collections are matched against them (Match), each source only looking at the targets of its 3x3 cell neighbourhood
+//The cone test is getDR(...) < maxDR of etaPhiFunc.h in its own float arithmetic, compared as dR^2 against the precomputed float
+//limit, so matches are bit for bit those of the nested getDR loops. Modes:
+// greedy    - sources in order, each to the lowest-index unmatched target in the cone (the nested loops' first match)
+// ptordered - sources by decreasing pt, each to the closest unmatched target in the cone
+// drordered - all source-target pairs in the cone by increasing dR, each taken if both jets are still unmatched
+class jetMatcher
+{
+ public:
+  enum matchMode{matchGreedy = 0, matchPtOrdered = 1, matchDROrdered = 2};
+
+  jetMatcher(){};
+  jetMatcher(double inMaxDR, matchMode inMode = matchGreedy);
+  ~jetMatcher(){};
+
+  bool Init(double inMaxDR, matchMode inMode = matchGreedy);
+  bool SetTargets(int nTarget, const float* eta_p, const float* phi_p);
+  //sourceMatch_p[sI] gets the matched target or -1, targetMatch_p[tI] (if given) the matched source or -1; pt_p only read w/ ptordered
+  bool Match(int nSource, const float* eta_p, const float* phi_p, const float* pt_p, int* sourceMatch_p, int* targetMatch_p = nullptr);
+
+  bool GetIsInit(){return m_isInit;}
+  double GetMaxDR(){return m_maxDR;}
+  matchMode GetMode(){return m_mode;}
+  void Clean();
+  void Print();
+
+  static bool StrToMode(std::string modeStr, matchMode* mode_p);
+  static std::string ModeToStr(matchMode mode);
+
+ private:
+  bool m_isInit = false;
+  double m_maxDR = 0.0;
+  matchMode m_mode = matchGreedy;
+  float m_dR2Limit = 0.0; //Smallest dR^2 whose getDR is not < maxDR
+
+  //Targets, binned - w/ a target phi outside [-pi, pi] getDR's single phi wrap is not the angular distance, so all targets are scanned
+  int m_nTarget = 0;
+  bool m_useGrid = false;
+  double m_cellWidth = 0.0;
+  double m_minEta = 0.0;
+  int m_nEtaCell = 0;
+  int m_nPhiCell = 0;
+  std::vector<unsigned int> m_cellStart;
+  std::vector<int> m_cellTarget; //Target index, by cell; targets w/ non-finite eta or phi can never match and are left out
+  std::vector<float> m_cellEta, m_cellPhi;
+
+  //Scratch
+  std::vector<float> m_dR2;
+  std::vector<int> m_candTarget;
+  std::vector<float> m_candDR2;
+  std::vector<int> m_sourceOrder;
+  std::vector<char> m_targetUsed;
+  struct matchPair{
+    float dR2;
+    int source, target;
+  };
+  std::vector<matchPair> m_pairs;
+
+  void FillCandidates(float eta, float phi);
+  void ScanRange(float eta, float phi, unsigned int begin, unsigned int end);
+};
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef KINEMATICKERNEL_H
+#define KINEMATICKERNEL_H
+
+//cpp
+#include <string>
+
+//Batch (pt, eta, phi[, m]) -> (px, py, pz, E) over SoA arrays, shared by constituentBuilder and the truth loops of makeClusterTree and clusterToCS
+//sin/cos come from one reduction and sinh/cosh from one exp per element; the loop is compiled for AVX-512, AVX2 and baseline
+//x86-64 and picked at runtime. No FMA contraction is allowed in the kernel, so every path returns bit-identical results
+//Accuracy vs. libm is a few ulp for |phi| < 1e5 and |eta| < 700 (|eta| is clamped there); small |eta| pz is good to ~1e-16 absolute
+//m_p == nullptr is massless: E = pt*cosh(eta); otherwise E = sqrt((pt*cosh(eta))^2 + m^2), as TLorentzVector::SetPtEtaPhiM for m >= 0
+void ptEtaPhiToPxPyPzE(const float* pt_p, const float* eta_p, const float* phi_p, const float* m_p, unsigned int n, double* px_p, double* py_p, double* pz_p, double* E_p);
+void ptEtaPhiToPxPyPzE(const double* pt_p, const double* eta_p, const double* phi_p, const double* m_p, unsigned int n, double* px_p, double* py_p, double* pz_p, double* E_p);
+
+//Baseline path only, for validation against the dispatched one
+void ptEtaPhiToPxPyPzEScalar(const float* pt_p, const float* eta_p, const float* phi_p, const float* m_p, unsigned int n, double* px_p, double* py_p, double* pz_p, double* E_p);
+void ptEtaPhiToPxPyPzEScalar(const double* pt_p, const double* eta_p, const double* phi_p, const double* m_p, unsigned int n, double* px_p, double* py_p, double* pz_p, double* E_p);
+
+//"avx512f", "avx2" or "scalar"
+std::string getKinematicKernelISA();
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef PTETAPHIVIEW_H
+#define PTETAPHIVIEW_H
+
+//cpp
+#include <vector>
+
+//FastJet
+#include "fastjet/PseudoJet.hh"
+
+//Read-only views over particle collections - let kernels (e.g. rhoBuilder) run directly on branch buffers w/o copying into temporaries
+//All views share the same accessor interface: size(), pass(i), pt(i), eta(i), phi(i)
+
+//Pointer+length view over three parallel arrays (e.g. std::vector<float> branch buffers), w/ optional ID mask
+template <typename T>
+class ptEtaPhiView
+{
+ public:
+  ptEtaPhiView(const T* pt_p, const T* eta_p, const T* phi_p, unsigned int size, const std::vector<bool>* id_p = nullptr) : m_pt_p(pt_p), m_eta_p(eta_p), m_phi_p(phi_p), m_size(size), m_id_p(id_p){}
+  ptEtaPhiView(const std::vector<T>* pt_p, const std::vector<T>* eta_p, const std::vector<T>* phi_p, const std::vector<bool>* id_p = nullptr) : m_pt_p(pt_p->data()), m_eta_p(eta_p->data()), m_phi_p(phi_p->data()), m_size(pt_p->size()), m_id_p(id_p){}
+
+  unsigned int size() const {return m_size;}
+  bool pass(unsigned int pI) const {return m_id_p == nullptr || (*m_id_p)[pI];}
+  double pt(unsigned int pI) const {return m_pt_p[pI];}
+  double eta(unsigned int pI) const {return m_eta_p[pI];}
+  double phi(unsigned int pI) const {return m_phi_p[pI];}
+
+ private:
+  const T* m_pt_p;
+  const T* m_eta_p;
+  const T* m_phi_p;
+  unsigned int m_size;
+  const std::vector<bool>* m_id_p;
+};
+
+//Strided accessor over a PseudoJet collection - pt/eta/phi are read per element, nothing is copied
+class pseudoJetView
+{
+ public:
+  pseudoJetView(const std::vector<fastjet::PseudoJet>* jets_p) : m_jets_p(jets_p){}
+
+  unsigned int size() const {return m_jets_p->size();}
+  bool pass(unsigned int) const {return true;}
+  double pt(unsigned int pI) const {return (*m_jets_p)[pI].pt();}
+  double eta(unsigned int pI) const {return (*m_jets_p)[pI].eta();}
+  double phi(unsigned int pI) const {return (*m_jets_p)[pI].phi_std();}
+
+ private:
+  const std::vector<fastjet::PseudoJet>* m_jets_p;
+};
+
+#endif
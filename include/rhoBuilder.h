@@ -10,7 +10,10 @@
 #include "fastjet/PseudoJet.hh"
 
 //Local
+#include "include/binFinder.h"
 #include "include/globalDebugHandler.h"
+#include "include/ptEtaPhiView.h"
+#include "include/segmentAreaTable.h"
 
 class rhoBuilder{
  public:
@@ -26,10 +29,19 @@ class rhoBuilder{
   bool CalcRhoFromPtEtaPhi(std::vector<double>* pt_p, std::vector<double>* eta_p, std::vector<double>* phi_p, std::vector<fastjet::PseudoJet>* jets_p=nullptr, bool doTowerExclude=false);
   bool CalcRhoFromPtEtaPhiID(std::vector<float>* pt_p, std::vector<float>* eta_p, std::vector<float>* phi_p, std::vector<bool>* id_p, std::vector<fastjet::PseudoJet>* jets_p=nullptr, bool doTowerExclude=false);
   bool CalcRhoFromPtEtaPhiID(std::vector<double>* pt_p, std::vector<double>* eta_p, std::vector<double>* phi_p, std::vector<bool>* id_p, std::vector<fastjet::PseudoJet>* jets_p=nullptr, bool doTowerExclude=false);
-  bool SetRho(std::vector<double>* rho_p, std::vector<double>* area_p=nullptr);
-  bool SetRho(std::vector<float>* rho_p, std::vector<float>* area_p=nullptr);
-  bool SetRhoPt(std::vector<double>* rhoPt_p);
-  bool SetRhoPt(std::vector<float>* rhoPt_p);
+  //Multi-exclusion: one sweep over the inputs gives one rho/area set per entry of jetSets (nullptr entry == no exclusion); retrieve w/ SetRho(..., setPos)
+  bool CalcRhoFromPtEtaPhiMulti(std::vector<float>* pt_p, std::vector<float>* eta_p, std::vector<float>* phi_p, std::vector<std::vector<fastjet::PseudoJet>*> jetSets, bool doTowerExclude=false);
+  bool CalcRhoFromPtEtaPhiMulti(std::vector<double>* pt_p, std::vector<double>* eta_p, std::vector<double>* phi_p, std::vector<std::vector<fastjet::PseudoJet>*> jetSets, bool doTowerExclude=false);
+  bool CalcRhoFromPtEtaPhiIDMulti(std::vector<float>* pt_p, std::vector<float>* eta_p, std::vector<float>* phi_p, std::vector<bool>* id_p, std::vector<std::vector<fastjet::PseudoJet>*> jetSets, bool doTowerExclude=false);
+  bool CalcRhoFromPtEtaPhiIDMulti(std::vector<double>* pt_p, std::vector<double>* eta_p, std::vector<double>* phi_p, std::vector<bool>* id_p, std::vector<std::vector<fastjet::PseudoJet>*> jetSets, bool doTowerExclude=false);
+  template <class View>
+  bool CalcRhoFromView(const View& inputs, const std::vector<std::vector<fastjet::PseudoJet>*>& jetSets, bool doTowerExclude=false); //Instantiated for ptEtaPhiView<float>, ptEtaPhiView<double>, pseudoJetView
+  bool SetRho(std::vector<double>* rho_p, std::vector<double>* area_p=nullptr, unsigned int setPos=0);
+  bool SetRho(std::vector<float>* rho_p, std::vector<float>* area_p=nullptr, unsigned int setPos=0);
+  bool SetRhoPt(std::vector<double>* rhoPt_p, unsigned int setPos=0);
+  bool SetRhoPt(std::vector<float>* rhoPt_p, unsigned int setPos=0);
+  void SetDoAnalyticArea(bool inDoAnalyticArea){m_doAnalyticArea = inDoAnalyticArea;} //Reference mode for the jet/eta-strip overlap, default is table lookup
+  bool GetDoAnalyticArea(){return m_doAnalyticArea;}
   void Clean();
   void Print();
   
@@ -39,14 +51,35 @@ class rhoBuilder{
   
   bool m_isInit;
   std::vector<double> m_etaBins;
-  std::vector<double> m_rhoVals;  
-  std::vector<double> m_rhoPtVals;  
-  std::vector<double> m_areaVals;  
-  std::vector<int> m_nExcluded;
+  //Per exclusion set, per eta bin
+  std::vector<std::vector<double> > m_rhoVals;
+  std::vector<std::vector<double> > m_rhoPtVals;
+  std::vector<std::vector<double> > m_areaVals;
+  std::vector<std::vector<int> > m_nExcluded;
+  unsigned int m_nSets = 0; //Sets filled by the last CalcRho* call
 
   std::vector<double> m_towerPhiBounds;
 
-  int posInBins(double val, std::vector<double>* bins);
+  bool m_doAnalyticArea = false;
+  segmentAreaTable m_areaTable;
+
+  binFinder m_etaBinFinder;
+  binFinder m_phiBinFinder;
+
+  //Eta-phi occupancy mask of the excluded jets, one cell per eta bin x tower phi bin
+  //Cells fully inside a jet need no dR check, cells clear of all jets are skipped, boundary cells only check the jets touching them
+  enum maskState{maskClear=0, maskPartial=1, maskFull=2};
+  struct exclusionMask{
+    std::vector<char> state;
+    std::vector<std::vector<unsigned int> > jets;
+    std::vector<int> touched;
+  };
+  std::vector<exclusionMask> m_masks; //One per exclusion set
+
+  bool ResizeSets(unsigned int nSets);
+  void BuildExclusionMask(std::vector<fastjet::PseudoJet>* jets_p, exclusionMask* mask_p);
+  void ClearExclusionMask(exclusionMask* mask_p);
+  bool InExcludedJet(const exclusionMask& mask, int etaPos, double eta, double phi, std::vector<fastjet::PseudoJet>* jets_p);
 };
 
 #endif 
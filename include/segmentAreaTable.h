@@ -0,0 +1,47 @@
+#ifndef SEGMENTAREATABLE_H
+#define SEGMENTAREATABLE_H
+
+//cpp
+#include <vector>
+
+//Tabulated circle-chord function for jet/eta-strip overlap areas (see testSegmentArea.C for the geometry)
+//All of rhoBuilder's overlap branches reduce to h(d) = d*sqrt(R^2 - d^2) - R^2*acos(d/R), d in [-R, R]
+//h is width-independent, so one table built at Init serves every eta bin; EvalAnalytic is the exact reference
+class segmentAreaTable
+{
+ public:
+  segmentAreaTable(){};
+  segmentAreaTable(double inR, int inNPoints = 4096);
+  ~segmentAreaTable(){};
+
+  bool Init(double inR, int inNPoints = 4096);
+  inline double Eval(double d) const;
+  double EvalAnalytic(double d) const;
+  double GetMaxInterpError();
+
+  bool GetIsInit(){return m_isInit;}
+  double GetR(){return m_R;}
+  void Clean();
+  void Print();
+
+ private:
+  bool m_isInit = false;
+  double m_R = 0.0;
+  int m_nPoints = 0;
+  double m_invStep = 0.0;
+  std::vector<double> m_vals;
+};
+
+//Linear interpolation; d outside [-R, R] clamps to the end points, matching the analytic limits
+inline double segmentAreaTable::Eval(double d) const
+{
+  double x = (d + m_R)*m_invStep;
+  if(!(x > 0.0)) return m_vals[0];
+  else if(x >= (double)(m_nPoints - 1)) return m_vals[m_nPoints - 1];
+
+  const int pos = (int)x;
+  const double frac = x - (double)pos;
+  return m_vals[pos] + frac*(m_vals[pos+1] - m_vals[pos]);
+}
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef TREEREADAHEAD_H
+#define TREEREADAHEAD_H
+
+//cpp
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//ROOT
+#include "TTree.h"
+
+//Read-ahead stage for sequential TTree loops: a background thread runs TTree::GetEntry for the next nBuffers entries into a ring
+//of event buffers, and GetEntry on the loop side only waits for the entry to be ready and swaps it into the caller's variables
+//Branches are registered w/ SetBranchAddress in place of TTree::SetBranchAddress (same address types); the caller keeps
+//SetBranchStatus. Enabled branches are put in an explicitly sized TTreeCache over the [0, nEntries) range
+//nBuffers == 0 reads synchronously through the same interface. Entries must be consumed in order 0, 1, 2, ...
+//While running, the input tree and its file belong to the reader thread - Stop() before touching either again
+class treeReadAhead
+{
+ public:
+  treeReadAhead(){};
+  treeReadAhead(TTree* inTree_p, ULong64_t inNEntries, unsigned int inNBuffers, Long64_t inCacheSizeBytes);
+  ~treeReadAhead();
+
+  bool Init(TTree* inTree_p, ULong64_t inNEntries, unsigned int inNBuffers, Long64_t inCacheSizeBytes);
+
+  //A null vector pointer gets a vector owned by the reader, as TTree::SetBranchAddress would allocate one
+  bool SetBranchAddress(std::string branchName, Int_t* address_p);
+  bool SetBranchAddress(std::string branchName, UInt_t* address_p);
+  bool SetBranchAddress(std::string branchName, Float_t* address_p);
+  bool SetBranchAddress(std::string branchName, Double_t* address_p);
+  bool SetBranchAddress(std::string branchName, std::vector<float>** address_p);
+  bool SetBranchAddress(std::string branchName, std::vector<double>** address_p);
+  bool SetBranchAddress(std::string branchName, std::vector<int>** address_p);
+  bool SetBranchAddress(std::string branchName, std::vector<bool>** address_p);
+
+  bool Start();
+  bool GetEntry(ULong64_t entry);
+  void Stop();
+
+  bool GetIsInit(){return m_isInit;}
+  unsigned int GetNBuffers(){return m_nBuffers;}
+  double GetWaitSeconds(){return m_waitSeconds;} //Total time GetEntry spent blocked on the reader thread
+  void Clean();
+  void Print();
+
+  //Type-erased per-branch storage: one staging object bound to the tree plus one buffer per ring position
+  class branchRing
+  {
+  public:
+    virtual ~branchRing(){};
+    virtual bool Bind(TTree* tree_p, std::string branchName) = 0; //Staging object to the tree branch; the caller's address is only touched on success
+    virtual void Stash(unsigned int bufPos) = 0; //staging -> ring[bufPos], reader thread
+    virtual void Deliver(unsigned int bufPos) = 0; //ring[bufPos] -> caller, loop thread
+  };
+
+ private:
+  bool m_isInit = false;
+  bool m_isStarted = false;
+  TTree* m_tree_p = nullptr;
+  ULong64_t m_nEntries = 0;
+  unsigned int m_nBuffers = 0;
+  Long64_t m_cacheSizeBytes = 0;
+  double m_waitSeconds = 0.0;
+
+  std::vector<std::string> m_branchNames;
+  std::vector<branchRing*> m_rings;
+
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  ULong64_t m_nReady = 0; //Entries [0, m_nReady) are in the ring or already delivered
+  ULong64_t m_nDelivered = 0;
+  bool m_doStop = false;
+  bool m_readFailed = false;
+  ULong64_t m_failedEntry = 0;
+
+  bool AddRing(std::string branchName, branchRing* ring_p);
+  bool ReadEntry(ULong64_t entry, unsigned int bufPos);
+  void ReadLoop();
+};
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef TRUTHSIDECAR_H
+#define TRUTHSIDECAR_H
+
+//cpp
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+//ROOT
+#include "TFile.h"
+#include "TTree.h"
+
+//Per-event cache of truth-level products keyed by (run, lumi, event), so MC reprocessing w/ new reco settings skips truth clustering
+//Init opens an existing sidecar for reading - its columns and parameter string (everything the cached products depend on) must
+//match - or starts a new one for writing. Columns are named float vectors, any length per event
+//A new sidecar is written to <file>.tmp and only renamed to <file> by a successful Close(), so an aborted job leaves no partial cache
+//Get and Fill are not thread-safe - call them from the serial part of the event loop
+class truthSidecar
+{
+ public:
+  truthSidecar(){};
+  ~truthSidecar();
+
+  bool Init(std::string inFileName, std::vector<std::string> inColumnNames, std::string inParamStr);
+
+  //Read mode; *isFound_p false (and columns_p untouched) for events the sidecar does not have - compute those as usual
+  bool Get(Int_t run, UInt_t lumi, Int_t evt, std::vector<std::vector<float> >* columns_p, bool* isFound_p);
+  //Write mode; one vector per column, in Init order
+  bool Fill(Int_t run, UInt_t lumi, Int_t evt, const std::vector<std::vector<float> >& columns);
+  bool Close();
+
+  bool GetIsInit(){return m_isInit;}
+  bool GetIsReading(){return m_isReading;}
+  unsigned int GetNColumns(){return m_columnNames.size();}
+  void Clean();
+  void Print();
+
+ private:
+  bool m_isInit = false;
+  bool m_isReading = false;
+  std::string m_fileName = "";
+  std::string m_paramStr = "";
+  std::vector<std::string> m_columnNames;
+
+  TFile* m_file_p = nullptr;
+  TTree* m_tree_p = nullptr;
+  Int_t m_run = -1;
+  UInt_t m_lumi = 0;
+  Int_t m_evt = -1;
+  std::vector<std::vector<float>*> m_columns_p; //Branch buffers, owned
+
+  std::map<std::tuple<Int_t, UInt_t, Int_t>, Long64_t> m_index; //Read mode - key to sidecar entry
+  unsigned long long m_nFound = 0;
+  unsigned long long m_nMissing = 0;
+  unsigned long long m_nFilled = 0;
+
+  std::string GetColumnStr();
+};
+
+#endif